@@ -0,0 +1,231 @@
+#include "Animation.h"
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+/**
+ * Converts the absolute number of frames played into a spritesheet frame index
+ * @param clip Clip being played
+ * @param step Number of whole frames elapsed since the clip started
+ * @return Frame index in the spritesheet
+ */
+static int frameForStep(const AnimationClip& clip, long step) {
+    // A single frame clip never changes
+    if (clip.frameCount <= 1) return 0;
+
+    switch (clip.loop) {
+        case LoopMode::Once:
+            // Hold the last frame once the clip has finished
+            return step < clip.frameCount ? static_cast<int>(step) : clip.frameCount - 1;
+        case LoopMode::PingPong: {
+            // One period goes up to the last frame and back, without repeating either end
+            long period = 2 * (clip.frameCount - 1);
+            long position = step % period;
+            return static_cast<int>(position < clip.frameCount ? position : period - position);
+        }
+        case LoopMode::Loop:
+        default:
+            return static_cast<int>(step % clip.frameCount);
+    }
+}
+
+/**
+ * Converts playback time into the number of whole frames played
+ * @param clip Clip being played
+ * @param elapsed Time since the clip started playing
+ * @return Number of whole frames elapsed (never negative)
+ */
+static long stepAt(const AnimationClip& clip, float elapsed) {
+    if (elapsed <= 0.f) return 0;
+    return static_cast<long>(std::floor(elapsed * clip.fps));
+}
+
+/**
+ * load implementation
+ * Parses the clip definition file line by line
+ * Invalid lines are reported and skipped so one typo does not break every animation
+ * @param fileName Path of the clip definition file
+ * @param assets Bundle the spritesheets are loaded from
+ * @param uploadTextures false to only read spritesheet sizes
+ * @return true if the file was read and every line was valid
+ */
+bool AnimationLibrary::load(const char* fileName, const AssetBundle& assets, bool uploadTextures) {
+    std::ifstream file(fileName);
+    if (!file) {
+        TraceLog(LOG_WARNING, "ANIMATION: [%s] Failed to open clip definitions", fileName);
+        return false;
+    }
+
+    bool valid = true;
+    int lineNumber = 0;
+    std::string line;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        // Strip comments and skip blank lines
+        line = line.substr(0, line.find('#'));
+        std::istringstream fields(line);
+        std::string kind;
+        if (!(fields >> kind)) continue;
+
+        if (kind == "clip") {
+            // clip <name> <sheet path> <frame count> <fps> <loop mode>
+            AnimationClip clip;
+            std::string sheetPath, loop;
+            if (!(fields >> clip.name >> sheetPath >> clip.frameCount >> clip.fps >> loop) ||
+                clip.frameCount < 1 || clip.fps <= 0.f || findClip(clip.name) != -1)
+            {
+                TraceLog(LOG_WARNING, "ANIMATION: [%s:%i] Invalid clip definition", fileName, lineNumber);
+                valid = false;
+                continue;
+            }
+            if (loop == "loop") clip.loop = LoopMode::Loop;
+            else if (loop == "once") clip.loop = LoopMode::Once;
+            else if (loop == "pingpong") clip.loop = LoopMode::PingPong;
+            else {
+                TraceLog(LOG_WARNING, "ANIMATION: [%s:%i] Unknown loop mode '%s'", fileName, lineNumber, loop.c_str());
+                valid = false;
+                continue;
+            }
+
+            // Frames are laid out horizontally in a single row; a sheet that failed to load
+            // or does not split into whole frames would give invisible or cropped characters
+            clip.sheet = loadSheet(sheetPath, assets, uploadTextures);
+            if (clip.sheet.width <= 0 || clip.sheet.height <= 0 || clip.sheet.width % clip.frameCount != 0) {
+                TraceLog(LOG_WARNING, "ANIMATION: [%s:%i] Spritesheet '%s' is missing or not %i frames wide",
+                         fileName, lineNumber, sheetPath.c_str(), clip.frameCount);
+                valid = false;
+                continue;
+            }
+            clip.frameWidth = static_cast<float>(clip.sheet.width / clip.frameCount);
+            clip.frameHeight = static_cast<float>(clip.sheet.height);
+            clips.push_back(clip);
+        } else if (kind == "event") {
+            // event <clip name> <frame> <event name>
+            std::string clipName;
+            AnimationEvent event;
+            int clipId = -1;
+            if (!(fields >> clipName >> event.frame >> event.name) ||
+                (clipId = findClip(clipName)) == -1 ||
+                event.frame < 0 || event.frame >= clips[clipId].frameCount)
+            {
+                TraceLog(LOG_WARNING, "ANIMATION: [%s:%i] Invalid event definition", fileName, lineNumber);
+                valid = false;
+                continue;
+            }
+            clips[clipId].events.push_back(event);
+        } else {
+            TraceLog(LOG_WARNING, "ANIMATION: [%s:%i] Unknown definition '%s'", fileName, lineNumber, kind.c_str());
+            valid = false;
+        }
+    }
+
+    TraceLog(LOG_INFO, "ANIMATION: [%s] Loaded %i clips", fileName, static_cast<int>(clips.size()));
+    return valid;
+}
+
+/**
+ * unload implementation
+ * Releases every spritesheet exactly once, even if several clips share it
+ * (sizes-only spritesheets have id 0, which UnloadTexture ignores)
+ */
+void AnimationLibrary::unload() {
+    for (auto sheet : sheets) {
+        UnloadTexture(sheet);
+    }
+    sheets.clear();
+    sheetPaths.clear();
+    clips.clear();
+}
+
+/**
+ * findClip implementation
+ * Linear search by name; only used when characters are created, never per frame
+ * @param name Name of the clip
+ * @return Clip id, or -1 if no clip has that name
+ */
+int AnimationLibrary::findClip(const std::string& name) const {
+    for (size_t i = 0; i < clips.size(); i++) {
+        if (clips[i].name == name) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+/**
+ * frameAt implementation
+ * @param clipId Id of the clip
+ * @param elapsed Time since the clip started playing
+ * @return Frame index in the spritesheet (0 for an invalid clip)
+ */
+int AnimationLibrary::frameAt(int clipId, float elapsed) const {
+    if (clipId < 0 || clipId >= static_cast<int>(clips.size())) return 0;
+    const AnimationClip& clip = clips[clipId];
+    return frameForStep(clip, stepAt(clip, elapsed));
+}
+
+/**
+ * frameRec implementation
+ * @param clipId Id of the clip
+ * @param elapsed Time since the clip started playing
+ * @param rightLeft Facing direction: 1.0 = right, -1.0 = left (negative width flips the frame)
+ * @return Rectangle selecting the frame in the clip's spritesheet (empty for an invalid clip)
+ */
+Rectangle AnimationLibrary::frameRec(int clipId, float elapsed, float rightLeft) const {
+    if (clipId < 0 || clipId >= static_cast<int>(clips.size())) return Rectangle{};
+    const AnimationClip& clip = clips[clipId];
+    return Rectangle{
+        frameAt(clipId, elapsed) * clip.frameWidth,     // X offset of the frame in the sheet
+        0.f,                                            // Single row spritesheet
+        rightLeft * clip.frameWidth,                    // Width, flipped when facing left
+        clip.frameHeight                                // Height of a frame
+    };
+}
+
+/**
+ * collectEvents implementation
+ * Frame k starts at playback time k / fps; every frame starting in [from, to) is reported,
+ * so consecutive intervals report each frame exactly once, including frame 0 at the clip's start
+ * At most one full cycle is reported, so a long hitch does not flood the caller
+ * @param clipId Id of the clip
+ * @param from Playback time at the previous update
+ * @param to Playback time at the current update
+ * @param fired Receives the events that were reached (appended)
+ */
+void AnimationLibrary::collectEvents(int clipId, float from, float to, std::vector<const AnimationEvent*>& fired) const {
+    if (clipId < 0 || clipId >= static_cast<int>(clips.size())) return;
+    const AnimationClip& clip = clips[clipId];
+    if (clip.events.empty()) return;
+
+    // First and last frame steps starting inside the interval (no frames before the clip started)
+    long first = static_cast<long>(std::ceil(from * clip.fps));
+    if (first < 0) first = 0;
+    long last = static_cast<long>(std::ceil(to * clip.fps)) - 1;
+    // A clip played once has no frames after its last one
+    if (clip.loop == LoopMode::Once && last > clip.frameCount - 1) last = clip.frameCount - 1;
+    long cycle = clip.loop == LoopMode::PingPong ? 2 * (clip.frameCount - 1) : clip.frameCount;
+    if (cycle < 1) cycle = 1;
+    if (last - first >= cycle) first = last - cycle + 1;
+
+    for (long step = first; step <= last; step++) {
+        int frame = frameForStep(clip, step);
+        for (const auto& event : clip.events) {
+            if (event.frame == frame) fired.push_back(&event);
+        }
+    }
+}
+
+/**
+ * loadSheet implementation
+ * @param path Path of the spritesheet image
+ * @param assets Bundle the spritesheet is loaded from
+ * @param upload false to only read the spritesheet's size
+ * @return Loaded texture, shared with any clip that uses the same file
+ */
+Texture2D AnimationLibrary::loadSheet(const std::string& path, const AssetBundle& assets, bool upload) {
+    for (size_t i = 0; i < sheetPaths.size(); i++) {
+        if (sheetPaths[i] == path) return sheets[i];
+    }
+    Texture2D sheet = upload ? assets.loadTexture(path.c_str()) : assets.loadTextureInfo(path.c_str());
+    sheetPaths.push_back(path);
+    sheets.push_back(sheet);
+    return sheet;
+}
@@ -0,0 +1,199 @@
+// Header guard to prevent multiple inclusions
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+// Raylib library for graphics, textures, and vector/math types
+#include "raylib.h"
+// Pre-decoded textures the spritesheets are loaded from
+#include "AssetBundle.h"
+#include <string>
+#include <vector>
+
+/**
+ * How an animation clip behaves once its last frame has been shown
+ */
+enum class LoopMode {
+    Loop,       // Wrap back to the first frame
+    Once,       // Hold the last frame
+    PingPong    // Play forwards, then backwards, then forwards again
+};
+
+/**
+ * A named marker attached to a frame of a clip (e.g., footstep, attack hit)
+ */
+struct AnimationEvent {
+    // Frame index that triggers the event
+    int frame{0};
+    // Name of the event reported to gameplay code
+    std::string name;
+};
+
+/**
+ * AnimationClip
+ * Shared, read-only description of a single spritesheet animation
+ * Spritesheets are a single row of equally sized frames
+ */
+struct AnimationClip {
+    // Unique name used to look up the clip (e.g., "knight_run")
+    std::string name;
+    // Spritesheet texture (shared between clips using the same file)
+    Texture2D sheet{};
+    // Number of frames in the spritesheet
+    int frameCount{1};
+    // Playback speed in frames per second
+    float fps{12.f};
+    // Behaviour after the last frame
+    LoopMode loop{LoopMode::Loop};
+    // Width of a single frame (sheet width / frame count)
+    float frameWidth{0.f};
+    // Height of a single frame (full sheet height)
+    float frameHeight{0.f};
+    // Events fired when playback reaches a given frame
+    std::vector<AnimationEvent> events;
+};
+
+/**
+ * AnimationState
+ * Per-instance animation state: which clip is playing and since when
+ * The current frame is derived from these on demand, nothing is ticked per frame
+ */
+struct AnimationState {
+    // Index of the playing clip in the AnimationLibrary (-1 = none)
+    int clipId{-1};
+    // Clock time at which the clip started playing
+    float startTime{0.f};
+
+    /**
+     * Switches to another clip, restarting it only if it is not already playing
+     * @param id Clip to play
+     * @param now Current clock time
+     */
+    void play(int id, float now) {
+        if (clipId == id) return;
+        clipId = id;
+        startTime = now;
+    }
+};
+
+/**
+ * AnimationClock
+ * Single time source shared by every animated instance
+ * Advanced once per frame instead of once per character
+ */
+class AnimationClock {
+    public:
+        /**
+         * Advances the clock
+         * @param deltaTime Time elapsed since last frame
+         */
+        void advance(float deltaTime) {
+            previousTime = time;
+            time += deltaTime;
+        }
+
+        /**
+         * Gets the current clock time
+         * @return Seconds elapsed since the clock was created
+         */
+        float now() const { return time; }
+
+        /**
+         * Gets the clock time before the last advance
+         * Together with now() this is the interval covered by the current frame
+         * @return Clock time at the start of the current frame
+         */
+        float previous() const { return previousTime; }
+
+    private:
+        // Accumulated time in seconds
+        float time{0.f};
+        // Time before the last advance
+        float previousTime{0.f};
+};
+
+/**
+ * AnimationLibrary
+ * Owns every clip definition loaded from a data file
+ * Clips are defined once and shared by all characters that play them
+ */
+class AnimationLibrary {
+    public:
+        /**
+         * Loads clip definitions from a text file and the spritesheets they reference
+         * Each line is either a clip or an event definition ('#' starts a comment):
+         *   clip  <name> <sheet path> <frame count> <fps> <loop|once|pingpong>
+         *   event <clip name> <frame> <event name>
+         * @param fileName Path of the clip definition file
+         * @param assets Bundle the spritesheets are loaded from (falls back to image files)
+         * @param uploadTextures false to only read spritesheet sizes, for simulations without a window
+         * @return true if the file was read and every line was valid
+         */
+        bool load(const char* fileName, const AssetBundle& assets, bool uploadTextures = true);
+
+        /**
+         * Unloads all spritesheets and forgets every clip
+         */
+        void unload();
+
+        /**
+         * Looks up a clip by name
+         * @param name Name of the clip
+         * @return Clip id, or -1 if no clip has that name
+         */
+        int findClip(const std::string& name) const;
+
+        /**
+         * Gets a clip definition
+         * @param clipId Id returned by findClip (must be valid)
+         * @return Reference to the shared clip definition
+         */
+        const AnimationClip& getClip(int clipId) const { return clips[clipId]; }
+
+        /**
+         * Calculates which frame of a clip is shown after playing for a given time
+         * @param clipId Id of the clip
+         * @param elapsed Time since the clip started playing
+         * @return Frame index in the spritesheet
+         */
+        int frameAt(int clipId, float elapsed) const;
+
+        /**
+         * Calculates the source rectangle in the spritesheet for a given playback time
+         * @param clipId Id of the clip
+         * @param elapsed Time since the clip started playing
+         * @param rightLeft Facing direction: 1.0 = right, -1.0 = left (flips horizontally)
+         * @return Rectangle selecting the frame in the clip's spritesheet
+         */
+        Rectangle frameRec(int clipId, float elapsed, float rightLeft) const;
+
+        /**
+         * Collects the events of every frame that starts in the playback interval [from, to)
+         * A clip's frame 0 starts at playback time 0, so it is reported by the first interval after play
+         * Called on demand by code interested in events; for a character's last tick use
+         * from = clock.previous() - state.startTime and to = clock.now() - state.startTime
+         * @param clipId Id of the clip
+         * @param from Playback time at the previous update
+         * @param to Playback time at the current update
+         * @param fired Receives the events that were reached (appended)
+         */
+        void collectEvents(int clipId, float from, float to, std::vector<const AnimationEvent*>& fired) const;
+
+    private:
+        /**
+         * Loads a spritesheet, reusing the texture if another clip already loaded it
+         * @param path Path of the spritesheet image
+         * @param assets Bundle the spritesheet is loaded from
+         * @param upload false to only read the spritesheet's size (texture id stays 0)
+         * @return Loaded texture
+         */
+        Texture2D loadSheet(const std::string& path, const AssetBundle& assets, bool upload);
+
+        // All loaded clips, indexed by clip id
+        std::vector<AnimationClip> clips;
+        // Paths of the loaded spritesheets (parallel to sheets)
+        std::vector<std::string> sheetPaths;
+        // Loaded spritesheets, each unloaded once in unload()
+        std::vector<Texture2D> sheets;
+};
+
+#endif
@@ -0,0 +1,138 @@
+#include "AssetBundle.h"
+#include <cstring>
+
+/**
+ * bundleChecksum implementation
+ * FNV-1a: cheap enough to verify every texture at load time
+ * @param data Bytes to checksum
+ * @param size Number of bytes
+ * @return Checksum of the bytes
+ */
+uint32_t bundleChecksum(const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * open implementation
+ * Only the header and index are checked here; pixel data is verified per texture when loaded
+ * @param fileName Path of the bundle
+ * @return true if the bundle can be used
+ */
+bool AssetBundle::open(const char* fileName) {
+    close();
+    if (!file.open(fileName)) {
+        TraceLog(LOG_INFO, "BUNDLE: [%s] Not found, loading assets from image files", fileName);
+        return false;
+    }
+
+    // Header must be present and match this version of the game
+    BundleHeader header{};
+    if (file.size() < sizeof(header)) {
+        TraceLog(LOG_WARNING, "BUNDLE: [%s] File too small", fileName);
+        file.close();
+        return false;
+    }
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, bundleMagic, sizeof(bundleMagic)) != 0 || header.version != bundleVersion) {
+        TraceLog(LOG_WARNING, "BUNDLE: [%s] Unknown format or version", fileName);
+        file.close();
+        return false;
+    }
+
+    // Index must fit in the file and be intact
+    size_t indexSize = static_cast<size_t>(header.entryCount) * sizeof(BundleEntry);
+    if (file.size() - sizeof(header) < indexSize ||
+        bundleChecksum(file.data() + sizeof(header), indexSize) != header.indexChecksum)
+    {
+        TraceLog(LOG_WARNING, "BUNDLE: [%s] Corrupt index", fileName);
+        file.close();
+        return false;
+    }
+
+    entries = reinterpret_cast<const BundleEntry*>(file.data() + sizeof(header));
+    entryCount = header.entryCount;
+    TraceLog(LOG_INFO, "BUNDLE: [%s] Opened with %i textures", fileName, static_cast<int>(entryCount));
+    return true;
+}
+
+/**
+ * close implementation
+ */
+void AssetBundle::close() {
+    file.close();
+    entries = nullptr;
+    entryCount = 0;
+}
+
+/**
+ * loadTexture implementation
+ * Hands the mapped pixels to the GPU directly; nothing is decoded or copied on the CPU
+ * @param fileName Asset path of the texture
+ * @return Loaded texture
+ */
+Texture2D AssetBundle::loadTexture(const char* fileName) const {
+    const BundleEntry* entry = findEntry(fileName);
+    if (entry == nullptr) return LoadTexture(fileName);
+
+    // Data must lie inside the file and match the checksum written by the packer
+    if (entry->offset > file.size() || entry->size > file.size() - entry->offset ||
+        bundleChecksum(file.data() + entry->offset, entry->size) != entry->checksum)
+    {
+        TraceLog(LOG_WARNING, "BUNDLE: [%s] Corrupt data, loading from image file", fileName);
+        return LoadTexture(fileName);
+    }
+
+    // Image only borrows the mapped data; uploading does not write to it
+    Image image{
+        const_cast<unsigned char*>(file.data() + entry->offset),    // Pixel data
+        static_cast<int>(entry->width),                             // Width in pixels
+        static_cast<int>(entry->height),                            // Height in pixels
+        static_cast<int>(entry->mipmaps),                           // Mipmap levels
+        static_cast<int>(entry->format)                             // Pixel format
+    };
+    return LoadTextureFromImage(image);
+}
+
+/**
+ * loadTextureInfo implementation
+ * Reads the size from the index when the bundle has the texture, otherwise decodes the image file
+ * @param fileName Asset path of the texture
+ * @return Texture with id 0 and the texture's dimensions
+ */
+Texture2D AssetBundle::loadTextureInfo(const char* fileName) const {
+    const BundleEntry* entry = findEntry(fileName);
+    if (entry != nullptr) {
+        return Texture2D{
+            0,                                          // Never uploaded
+            static_cast<int>(entry->width),             // Width in pixels
+            static_cast<int>(entry->height),            // Height in pixels
+            static_cast<int>(entry->mipmaps),           // Mipmap levels
+            static_cast<int>(entry->format)             // Pixel format
+        };
+    }
+
+    // Decoding does not need a window, only uploading does
+    Image image = LoadImage(fileName);
+    Texture2D info{0, image.width, image.height, image.mipmaps, image.format};
+    UnloadImage(image);
+    return info;
+}
+
+/**
+ * findEntry implementation
+ * Linear search: bundles hold a handful of textures and are only searched at startup
+ * @param fileName Asset path of the texture
+ * @return Pointer to the entry, or nullptr if not found
+ */
+const BundleEntry* AssetBundle::findEntry(const char* fileName) const {
+    for (uint32_t i = 0; i < entryCount; i++) {
+        if (std::strncmp(entries[i].path, fileName, bundlePathSize) == 0) return &entries[i];
+    }
+    return nullptr;
+}
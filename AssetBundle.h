@@ -0,0 +1,131 @@
+// Header guard to prevent multiple inclusions
+#ifndef ASSET_BUNDLE_H
+#define ASSET_BUNDLE_H
+
+// Raylib library for graphics, textures, and vector/math types
+#include "raylib.h"
+// Memory mapping of the bundle file
+#include "MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Bundle file layout (written by tools/packer.cpp, native byte order):
+ *   BundleHeader
+ *   BundleEntry[entryCount]     index, one entry per texture
+ *   pixel data                  each entry's data starts on a bundleDataAlignment boundary
+ */
+
+// Identifies a bundle file
+static const char bundleMagic[4]{'C', 'C', 'A', 'B'};
+// Incremented whenever the layout changes
+static const uint32_t bundleVersion{3};
+// Alignment of each entry's pixel data inside the file
+static const uint64_t bundleDataAlignment{16};
+// Maximum length of an asset path, including the terminating zero
+static const int bundlePathSize{96};
+
+/**
+ * Start of the bundle file
+ */
+struct BundleHeader {
+    // Always bundleMagic
+    char magic[4];
+    // Always bundleVersion
+    uint32_t version;
+    // Number of BundleEntry records following the header
+    uint32_t entryCount;
+    // Checksum of the entry index
+    uint32_t indexChecksum;
+};
+
+/**
+ * Index record describing one pre-decoded texture
+ */
+struct BundleEntry {
+    // Asset path the texture was packed from (e.g., "characters/weapon_sword.png")
+    char path[bundlePathSize];
+    // Texture width in pixels
+    uint32_t width;
+    // Texture height in pixels
+    uint32_t height;
+    // Raylib pixel format of the data (uncompressed or GPU-compressed)
+    uint32_t format;
+    // Number of mipmap levels stored in the data
+    uint32_t mipmaps;
+    // Offset of the pixel data from the start of the file
+    uint64_t offset;
+    // Size of the pixel data in bytes
+    uint64_t size;
+    // Checksum of the pixel data
+    uint32_t checksum;
+    // Padding, always zero
+    uint32_t reserved;
+};
+
+static_assert(sizeof(BundleHeader) == 16, "BundleHeader layout must not change");
+static_assert(sizeof(BundleEntry) == 136, "BundleEntry layout must not change");
+
+/**
+ * Calculates the checksum used by bundles (32-bit FNV-1a)
+ * @param data Bytes to checksum
+ * @param size Number of bytes
+ * @return Checksum of the bytes
+ */
+uint32_t bundleChecksum(const void* data, size_t size);
+
+/**
+ * AssetBundle class
+ * Memory-mapped bundle of pre-decoded textures produced by the packer tool
+ * Textures are uploaded straight from the mapping, skipping PNG decoding
+ * and the many small file opens of loading assets one by one
+ */
+class AssetBundle {
+    public:
+        /**
+         * Maps a bundle file and validates its header and index
+         * @param fileName Path of the bundle
+         * @return true if the bundle can be used; otherwise textures load from their own files
+         */
+        bool open(const char* fileName);
+
+        /**
+         * Unmaps the bundle; textures already uploaded stay valid
+         */
+        void close();
+
+        /**
+         * Loads a texture from the bundle, falling back to the image file
+         * if the bundle is not open, does not contain it, or its data is corrupt
+         * The image file itself is not checked; rebuild the bundle after editing it
+         * @param fileName Asset path of the texture (as given to the packer)
+         * @return Loaded texture
+         */
+        Texture2D loadTexture(const char* fileName) const;
+
+        /**
+         * Gets a texture's size and format without uploading it to the GPU
+         * Used by simulations that run without a window; the returned texture has id 0
+         * and is only good for its dimensions
+         * @param fileName Asset path of the texture (as given to the packer)
+         * @return Texture with width, height, mipmaps and format filled in
+         */
+        Texture2D loadTextureInfo(const char* fileName) const;
+
+    private:
+        /**
+         * Finds the index entry of an asset
+         * @param fileName Asset path of the texture
+         * @return Pointer to the entry, or nullptr if the bundle does not contain it
+         */
+        const BundleEntry* findEntry(const char* fileName) const;
+
+        // Mapping of the whole bundle file
+        MappedFile file;
+        // Entry index inside the mapping (nullptr when no bundle is open)
+        const BundleEntry* entries{nullptr};
+        // Number of entries in the index
+        uint32_t entryCount{0};
+};
+
+#endif
@@ -4,11 +4,37 @@
 
 /**
  * Constructor implementation
- * Initializes the base character with default values
- * Member variables are initialized in the header file with default values
+ * Looks up the idle and run clips once so tick never searches by name
+ * @param animations Shared clip definitions
+ * @param clock Shared animation clock
+ * @param idleClipName Name of the clip played while standing still
+ * @param runClipName Name of the clip played while moving
  */
-BaseCharacter::BaseCharacter() {
-    // Default initialization handled by member initializers in header
+BaseCharacter::BaseCharacter(const AnimationLibrary& animations, const AnimationClock& clock,
+                             const std::string& idleClipName, const std::string& runClipName):
+    animations(&animations),
+    clock(&clock),
+    idleClip(animations.findClip(idleClipName)),
+    runClip(animations.findClip(runClipName))
+{
+    // A missing clip is reported and replaced by the other one, so the character
+    // is still drawn and keeps a collision box
+    if (idleClip == -1) {
+        TraceLog(LOG_WARNING, "CHARACTER: Unknown animation clip '%s'", idleClipName.c_str());
+        idleClip = runClip;
+    }
+    if (runClip == -1) {
+        TraceLog(LOG_WARNING, "CHARACTER: Unknown animation clip '%s'", runClipName.c_str());
+        runClip = idleClip;
+    }
+
+    // Start in the idle animation
+    animation.play(idleClip, clock.now());
+    // Collision size is the size of a single frame
+    if (idleClip != -1) {
+        width = animations.getClip(idleClip).frameWidth;
+        height = animations.getClip(idleClip).frameHeight;
+    }
 }
 
 /**
@@ -39,25 +65,13 @@ Rectangle BaseCharacter::GetCollisionRec(){
 /**
  * tick implementation
  * Main update method called every frame
- * Handles animation, movement, and rendering
+ * Handles animation state and movement
  * @param deltaTime Time elapsed since last frame (for frame-rate independent updates)
  */
 void BaseCharacter::tick(float deltaTime){
     // Save current position before any movement (for potential undo)
     worldPosLastFrame = worldPos;
     
-    // Update the animation frame based on elapsed time
-    runningTime += deltaTime;
-    // Advance to next frame when enough time has passed
-    if (runningTime >= updateTime) {
-        frame++;
-        runningTime = 0.f;  // Reset timer for next frame
-    }
-    // Loop animation back to first frame when reaching the end
-    if (frame >= maxFrames) {
-        frame = 0;
-    }   
-
     // Handle movement and animation state based on velocity
     if(Vector2Length(velocity) != 0) {
         // Character is moving: update position and set running animation
@@ -65,21 +79,47 @@ void BaseCharacter::tick(float deltaTime){
         worldPos = Vector2Add(worldPos, Vector2Scale(Vector2Normalize(velocity), speed));
         // Set facing direction based on velocity: left if negative X, right if positive X
         velocity.x < 0.f? rightLeft = -1.f : rightLeft = 1.f;
-        // Switch to running texture
-        texture = run;
+        // Switch to running animation (keeps playing if already running)
+        animation.play(runClip, clock->now());
     } else {
         // Character is not moving: reset velocity and use idle animation
         velocity = {0.f, 0.f};
-        texture = idle;
+        animation.play(idleClip, clock->now());
     }
     // Reset velocity after processing (will be set by derived classes for next frame)
     velocity = {0.f, 0.f};
+}
 
-    // Draw the character sprite
-    // Source rectangle: selects current frame from spritesheet, flips horizontally if facing left
-    Rectangle source{ frame* width, 0.0f, rightLeft* width, height };
-    // Destination rectangle: position and size on screen
-    Rectangle dest{ getScreenPos().x, getScreenPos().y, scale* width, scale* height };
+/**
+ * draw implementation
+ * Draws the current frame of the playing clip at the character's screen position
+ */
+void BaseCharacter::draw(){
+    // Dead characters are not drawn
+    if (!alive) return;
+
+    // Draw the character sprite (nothing to draw if the clip is missing)
+    if (animation.clipId == -1) return;
+    const AnimationClip& clip = animations->getClip(animation.clipId);
+    // Source rectangle: frame computed from the clip's start time, flips horizontally if facing left
+    Rectangle source = animations->frameRec(animation.clipId, clock->now() - animation.startTime, rightLeft);
+    // Destination rectangle: sized from the playing clip, so sheets with other frame sizes are not stretched
+    Rectangle dest{ getScreenPos().x, getScreenPos().y, scale* clip.frameWidth, scale* clip.frameHeight };
     // Draw the texture with source and destination rectangles
-    DrawTexturePro(texture, source, dest, Vector2{}, 0.f, WHITE);
+    DrawTexturePro(clip.sheet, source, dest, Vector2{}, 0.f, WHITE);
+}
+
+/**
+ * takeDamage implementation
+ * Applies damage to the character and checks if character should die
+ * @param damage Amount of damage to apply
+ */
+void BaseCharacter::takeDamage(float damage){
+    // Reduce health by damage amount
+    health -= damage;
+    // Check if health has reached zero or below
+    if (health <= 0.f) {
+        // Set character as dead
+        setAlive(false);
+    }
 }
\ No newline at end of file
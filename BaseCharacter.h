@@ -4,20 +4,28 @@
 
 // Raylib library for graphics, textures, and vector/math types
 #include "raylib.h"
+// Shared animation clips and clock
+#include "Animation.h"
+#include <string>
 
 /**
  * BaseCharacter class
  * Base class for all characters in the game (player, enemies, etc.)
- * Provides common functionality for movement, animation, collision detection, and rendering
+ * Provides common functionality for movement, animation, health, collision detection, and rendering
  * Uses virtual methods to allow derived classes to customize behavior
  */
 class BaseCharacter {  
     public:
         /**
-         * Default constructor
-         * Initializes the base character with default values
+         * Constructor
+         * Resolves the character's idle and run clips and sizes it from the idle frame
+         * @param animations Shared clip definitions
+         * @param clock Shared animation clock
+         * @param idleClipName Name of the clip played while standing still
+         * @param runClipName Name of the clip played while moving
          */
-        BaseCharacter();
+        BaseCharacter(const AnimationLibrary& animations, const AnimationClock& clock,
+                      const std::string& idleClipName, const std::string& runClipName);
         
         /**
          * Gets the character's world position
@@ -40,10 +48,17 @@ class BaseCharacter {
         /**
          * Virtual update method - called every frame
          * Derived classes should override this to implement their specific update logic
+         * Only updates state; nothing is drawn, so characters can be simulated without a window
          * @param deltaTime Time elapsed since last frame (for frame-rate independent movement)
          */
         virtual void tick(float deltaTime);
         
+        /**
+         * Virtual render method - called every frame after tick
+         * Draws the current animation frame; derived classes can draw extra parts (e.g., weapons)
+         */
+        virtual void draw();
+        
         /**
          * Pure virtual method - must be implemented by derived classes
          * Calculates the screen position based on world position and camera offset
@@ -62,14 +77,38 @@ class BaseCharacter {
          * @param isAlive true to set character as alive, false to set as dead
          */
         void setAlive(bool isAlive){ alive = isAlive; }
+        
+        /**
+         * Gets the current health of the character
+         * @return Current health value (0-100)
+         */
+        float getHealth() const { return health; }
+        
+        /**
+         * Applies damage to the character
+         * Reduces health and may set character as dead if health reaches 0
+         * @param damage Amount of damage to apply
+         */
+        void takeDamage(float damage);
+        
+        /**
+         * Gets the playing clip and the time it started
+         * Pass to AnimationLibrary::collectEvents to find the events reached (e.g., footsteps)
+         * @return Reference to the character's animation state
+         */
+        const AnimationState& getAnimation() const { return animation; }
 
     protected:
-        // Current texture being used for rendering (switches between idle/run)
-        Texture2D texture{ LoadTexture("characters/knight_idle_spritesheet.png") };
-        // Texture for idle animation
-        Texture2D idle{ LoadTexture("characters/knight_idle_spritesheet.png") };
-        // Texture for running animation
-        Texture2D run{ LoadTexture("characters/knight_run_spritesheet.png") };
+        // Shared clip definitions (spritesheets, frame counts, frame rates)
+        const AnimationLibrary* animations{};
+        // Shared clock the current frame is computed from
+        const AnimationClock* clock{};
+        // Clip played while standing still
+        int idleClip{-1};
+        // Clip played while moving
+        int runClip{-1};
+        // Playing clip and the time it started (frame is derived on demand)
+        AnimationState animation{};
 
         // Current position in world coordinates
         Vector2 worldPos{0.f, 0.f};
@@ -78,20 +117,12 @@ class BaseCharacter {
 
         // Direction facing: 1.0 = facing right, -1.0 = facing left
         float rightLeft{1.f};
-        // Accumulated time for animation frame calculation
-        float runningTime{0.f}; 
-        // Current animation frame index
-        int frame{0};
-        // Total number of frames in the animation spritesheet
-        int maxFrames{6};
-        // Time between animation frame updates (1/12 = 12 frames per second)
-        float updateTime{1.f/12.f}; 
         // Movement speed in pixels per frame
         float speed{4.f};
 
-        // Width of the character texture (calculated from texture)
+        // Collision width: frame width of the idle clip (drawing uses the playing clip's size)
         float width{0.f};
-        // Height of the character texture (calculated from texture)
+        // Collision height: frame height of the idle clip (drawing uses the playing clip's size)
         float height{0.f};
         // Scale factor for rendering the character texture
         float scale{4.f};
@@ -102,6 +133,8 @@ class BaseCharacter {
     private:
         // Whether the character is currently alive or dead
         bool alive{true};
+        // Current health value (starts at 100, character dies when it reaches 0)
+        float health{100.f};
 };
 
 #endif
\ No newline at end of file
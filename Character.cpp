@@ -4,19 +4,22 @@
 
 /**
  * Constructor implementation
- * Initializes the player character with window dimensions and calculates sprite dimensions
+ * Initializes the player character with window dimensions and the knight clips
+ * Sprite dimensions come from the clip definitions (see BaseCharacter)
  * @param windowWidth Width of the game window
  * @param windowHeight Height of the game window
+ * @param animations Shared clip definitions
+ * @param clock Shared animation clock
+ * @param weaponTexture Texture for the weapon (sword)
  */
-Character::Character(int windowWidth, int windowHeight):
+Character::Character(int windowWidth, int windowHeight, const AnimationLibrary& animations, const AnimationClock& clock,
+                     Texture2D weaponTexture):
+    BaseCharacter(animations, clock, "knight_idle", "knight_run"),
     windowWidth(windowWidth),
-    windowHeight(windowHeight)
+    windowHeight(windowHeight),
+    weapon(weaponTexture)
 {
-    // Calculate width of a single frame from the spritesheet
-    // Spritesheet contains multiple frames horizontally
-    width = texture.width/maxFrames;
-    // Height is the full height of the texture (single row spritesheet)
-    height = texture.height;
+    // Member variables initialized via initializer list above
 }
 
 /**
@@ -38,82 +41,61 @@ Vector2 Character::getScreenPos() {
 /**
  * tick implementation
  * Updates the player character each frame
- * Handles input, movement, weapon rendering, and calls base class update
+ * Handles input, movement, weapon swing, and calls base class update
  * @param deltaTime Time elapsed since last frame
  */
 void Character::tick(float deltaTime){
     // Skip update if character is dead
     if (!getAlive()) return;
 
-    // Handle keyboard input to set movement velocity
-    // WASD controls: W=up, S=down, A=left, D=right
-    if (IsKeyDown(KEY_A)) velocity.x += -1.0;  // Move left
-    if (IsKeyDown(KEY_D)) velocity.x += 1.0;    // Move right
-    if (IsKeyDown(KEY_W)) velocity.y += -1.0;   // Move up (negative Y is up in screen space)
-    if (IsKeyDown(KEY_S)) velocity.y += 1.0;    // Move down
+    // Movement velocity comes from this frame's input (keyboard or bot)
+    velocity = Vector2Add(velocity, input.move);
     
-    // Call base class tick to handle movement, animation, and base rendering
+    // Call base class tick to handle movement and animation
     BaseCharacter::tick(deltaTime);
 
-    // Weapon rendering and collision setup
-    Vector2 origin{};      // Rotation origin point for weapon
-    Vector2 offset{};      // Offset from character position to weapon position
-    float rotation{};      // Rotation angle for weapon (swing animation)
-    
-    // Calculate weapon position and collision based on facing direction
-    // facing right
-    if (rightLeft > 0.f) {
-        // Set rotation origin to bottom-left of weapon (for right-facing rotation)
-        origin = {0.f, weapon.height * scale};
-        // Offset weapon position relative to character (to the right side)
-        offset = {35.f, 55.f};
-        // Calculate weapon collision rectangle in screen space
-        weaponCollisionRec = {
-            getScreenPos().x + offset.x,                                    // X position
-            getScreenPos().y + offset.y - weapon.height * scale,           // Y position (adjusted for origin)
-            weapon.width * scale,                                           // Scaled width
-            weapon.height * scale                                           // Scaled height
-        };
-        // Rotate weapon when attacking (left mouse button pressed)
-        rotation = IsMouseButtonDown(MOUSE_BUTTON_LEFT) ? 35.f : 0.f;
-    } 
-    // facing left
-    else {
-        // Set rotation origin to bottom-right of weapon (for left-facing rotation)
-        origin = {weapon.width * scale, weapon.height * scale};
-        // Offset weapon position relative to character (to the left side)
-        offset = {25.f, 55.f};
-        // Calculate weapon collision rectangle (adjusted for left-facing)
-        weaponCollisionRec = {
-            getScreenPos().x + offset.x - weapon.width * scale,            // X position (adjusted for left-facing)
-            getScreenPos().y + offset.y - weapon.height * scale,           // Y position
-            weapon.width * scale,                                           // Scaled width
-            weapon.height * scale                                           // Scaled height
-        };
-        // Rotate weapon when attacking (negative rotation for left-facing)
-        rotation = IsMouseButtonDown(MOUSE_BUTTON_LEFT) ? -35.f : 0.f;
-    }
-    
-    // Prepare source rectangle from weapon texture (flip horizontally if facing left)
-    Rectangle source{0.f, 0.f, static_cast<float>(weapon.width) * rightLeft, static_cast<float>(weapon.height)};
-    // Prepare destination rectangle for rendering weapon on screen
-    Rectangle dest{getScreenPos().x + offset.x, getScreenPos().y + offset.y, weapon.width * scale, weapon.height * scale};
-    // Draw the weapon texture with rotation and proper origin point
-    DrawTexturePro(weapon, source, dest, origin, rotation, WHITE);
+    // Restart the swing when the attack button is pressed
+    if (input.attackPressed) swingTime = 0.f;
+    float progressBefore = input.attackPressed ? 0.f : swingTo;
+    swingTime += deltaTime;
+
+    // Offset from character position to weapon pivot, based on facing direction
+    // facing right: to the right side; facing left: to the left side
+    Vector2 offset = rightLeft > 0.f ? Vector2{35.f, 55.f} : Vector2{25.f, 55.f};
+
+    // Update the swing: the blade rotates around the pivot, away from the character
+    weaponSwing.pivot = Vector2Add(getScreenPos(), offset);
+    weaponSwing.bladeSize = {weapon.width * scale, weapon.height * scale};
+    weaponSwing.rightLeft = rightLeft;
+    // Rotate weapon through the arc while attacking (attack button held), then hold it
+    float progress = swingTime < weaponSwing.duration ? swingTime / weaponSwing.duration : 1.f;
+    weaponRotation = input.attackHeld ? rightLeft * weaponSwing.arc * progress : 0.f;
 
+    // Part of the arc the blade travelled this tick (hits are resolved along it)
+    swingFrom = progressBefore;
+    swingTo = progress;
+    swinging = input.attackPressed || (input.attackHeld && swingFrom < swingTo);
 }
 
 /**
- * takeDamage implementation
- * Applies damage to the character and checks if character should die
- * @param damage Amount of damage to apply
+ * draw implementation
+ * Draws the knight, then the weapon rotated around its pivot
  */
-void Character::takeDamage(float damage){
-    // Reduce health by damage amount
-    health -= damage;
-    // Check if health has reached zero or below
-    if (health <= 0.f) {
-        // Set character as dead
-        setAlive(false);
-    }
-}
\ No newline at end of file
+void Character::draw(){
+    // Skip drawing if character is dead
+    if (!getAlive()) return;
+
+    // Draw the knight sprite
+    BaseCharacter::draw();
+
+    // Rotation origin point for weapon: bottom-left when facing right, bottom-right when facing left
+    Vector2 origin = rightLeft > 0.f ?
+        Vector2{0.f, weapon.height * scale} :
+        Vector2{weapon.width * scale, weapon.height * scale};
+    // Prepare source rectangle from weapon texture (flip horizontally if facing left)
+    Rectangle source{0.f, 0.f, static_cast<float>(weapon.width) * rightLeft, static_cast<float>(weapon.height)};
+    // Prepare destination rectangle for rendering weapon on screen
+    Rectangle dest{weaponSwing.pivot.x, weaponSwing.pivot.y, weapon.width * scale, weapon.height * scale};
+    // Draw the weapon texture with rotation and proper origin point
+    DrawTexturePro(weapon, source, dest, origin, weaponRotation, WHITE);
+}
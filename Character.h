@@ -6,33 +6,64 @@
 #include "raylib.h"
 // Base class for character functionality
 #include "BaseCharacter.h"
+// Weapon swing description used for hit detection
+#include "Combat.h"
+
+/**
+ * Player input for one frame
+ * Filled from the keyboard and mouse by the game, or by a bot in simulations
+ */
+struct InputState {
+    // Movement direction (x: -1 left, 1 right; y: -1 up, 1 down); length does not matter
+    Vector2 move{};
+    // Attack button went down this frame (starts a swing)
+    bool attackPressed{false};
+    // Attack button is held (keeps the sword raised)
+    bool attackHeld{false};
+};
 
 /**
  * Character class
  * Represents the player character (knight) in the game
  * Inherits from BaseCharacter and adds player-specific features:
- * - Health system
- * - Weapon rendering and collision
+ * - Input-driven movement
+ * - Weapon rendering and swing
  * - Screen position calculation (centered on player)
  */
 class Character: public BaseCharacter {
     public:
         /**
          * Constructor
-         * Initializes the player character with window dimensions
+         * Initializes the player character with window dimensions and the knight clips
          * @param windowWidth Width of the game window (for screen position calculation)
          * @param windowHeight Height of the game window (for screen position calculation)
+         * @param animations Shared clip definitions
+         * @param clock Shared animation clock
+         * @param weaponTexture Texture for the weapon (sword)
          */
-        Character(int windowWidth, int windowHeight);
+        Character(int windowWidth, int windowHeight, const AnimationLibrary& animations, const AnimationClock& clock,
+                  Texture2D weaponTexture);
         
         /**
          * Override of BaseCharacter::tick
          * Updates the player character each frame
-         * Handles input, movement, weapon rendering, and calls base class tick
+         * Handles input, movement, weapon swing, and calls base class tick
          * @param deltaTime Time elapsed since last frame
          */
         virtual void tick(float deltaTime) override;
         
+        /**
+         * Override of BaseCharacter::draw
+         * Draws the knight and its weapon at the current swing rotation
+         */
+        virtual void draw() override;
+        
+        /**
+         * Sets the input the next tick acts on
+         * @param frameInput Movement and attack input for this frame
+         */
+        void setInput(const InputState& frameInput) { input = frameInput; }
+        
         /**
          * Override of BaseCharacter::getScreenPos (pure virtual)
          * Calculates the screen position of the character
@@ -42,24 +73,29 @@ class Character: public BaseCharacter {
         virtual Vector2 getScreenPos() override;
         
         /**
-         * Gets the collision rectangle for the character's weapon
-         * Used for combat collision detection with enemies
-         * @return Rectangle representing the weapon's collision bounds
+         * Gets the swing the character's weapon performs from its current position
+         * Used for combat hit detection with enemies (see resolveSwing)
+         * @return WeaponSwing describing the blade's pivot, size, facing and arc
+         */
+        const WeaponSwing& getWeaponSwing() const { return weaponSwing; }
+        
+        /**
+         * Checks whether the blade moved through part of its arc during the last tick
+         * @return true while the attack is held and the swing has not reached the end of its arc
          */
-        Rectangle getWeaponCollisionRec(){ return weaponCollisionRec; }
+        bool isSwinging() const { return swinging; }
         
         /**
-         * Gets the current health of the character
-         * @return Current health value (0-100)
+         * Gets the fraction of the arc the blade had travelled at the start of the last tick
+         * @return Progress from 0 (start of the arc) to 1 (end of the arc)
          */
-        float getHealth() const { return health; }
+        float getSwingFrom() const { return swingFrom; }
         
         /**
-         * Applies damage to the character
-         * Reduces health and may set character as dead if health reaches 0
-         * @param damage Amount of damage to apply
+         * Gets the fraction of the arc the blade had travelled at the end of the last tick
+         * @return Progress from 0 (start of the arc) to 1 (end of the arc)
          */
-        void takeDamage(float damage);
+        float getSwingTo() const { return swingTo; }
         
     private:
         // Width of the game window (used for centering player on screen)
@@ -67,11 +103,21 @@ class Character: public BaseCharacter {
         // Height of the game window (used for centering player on screen)
         int windowHeight{};
         // Texture for the weapon (sword)
-        Texture2D weapon{LoadTexture("characters/weapon_sword.png")};
-        // Collision rectangle for the weapon (updated each frame based on position and facing)
-        Rectangle weaponCollisionRec{};
-        // Current health value (starts at 100, character dies when it reaches 0)
-        float health{100.f};
+        Texture2D weapon{};
+        // Swing performed by the weapon (pivot and facing updated each frame)
+        WeaponSwing weaponSwing{};
+        // Time since the attack button was last pressed (drives the swing rotation)
+        float swingTime{0.f};
+        // Fraction of the arc travelled at the start of the last tick
+        float swingFrom{1.f};
+        // Fraction of the arc travelled at the end of the last tick
+        float swingTo{1.f};
+        // Whether the blade moved during the last tick (attack held, arc not finished)
+        bool swinging{false};
+        // Current weapon rotation in degrees (set by tick, used by draw)
+        float weaponRotation{0.f};
+        // Input for the current frame
+        InputState input{};
 };
 
 #endif
\ No newline at end of file
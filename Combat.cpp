@@ -0,0 +1,206 @@
+#include "Combat.h"
+// Raylib math utilities for vector operations
+#include "raymath.h"
+#include <algorithm>
+#include <cmath>
+
+// Largest rotation between two blade samples; small enough that the blade
+// cannot skip over a character-sized target between samples
+static const float maxSampleDegrees{5.f};
+
+/**
+ * Constructor implementation
+ * @param cellSize Width and height of a grid cell
+ */
+SpatialGrid::SpatialGrid(float cellSize):
+    cellSize(cellSize)
+{
+    // Member variables initialized via initializer list above
+}
+
+/**
+ * clear implementation
+ * Empties the cells without freeing them, since the grid is rebuilt often
+ */
+void SpatialGrid::clear() {
+    for (auto& cell : cells) {
+        cell.second.clear();
+    }
+    bounds.clear();
+}
+
+/**
+ * insert implementation
+ * @param id Small non-negative id of the entry
+ * @param entryBounds Collision rectangle of the entry
+ */
+void SpatialGrid::insert(int id, Rectangle entryBounds) {
+    if (id >= static_cast<int>(bounds.size())) bounds.resize(id + 1);
+    bounds[id] = entryBounds;
+
+    // Range of cells covered by the bounds
+    int minX = static_cast<int>(std::floor(entryBounds.x / cellSize));
+    int minY = static_cast<int>(std::floor(entryBounds.y / cellSize));
+    int maxX = static_cast<int>(std::floor((entryBounds.x + entryBounds.width) / cellSize));
+    int maxY = static_cast<int>(std::floor((entryBounds.y + entryBounds.height) / cellSize));
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            cells[cellKey(x, y)].push_back(id);
+        }
+    }
+}
+
+/**
+ * query implementation
+ * @param area Rectangle to search
+ * @param found Receives the ids of the candidates, each once
+ */
+void SpatialGrid::query(Rectangle area, std::vector<int>& found) const {
+    found.clear();
+
+    // Range of cells covered by the area
+    int minX = static_cast<int>(std::floor(area.x / cellSize));
+    int minY = static_cast<int>(std::floor(area.y / cellSize));
+    int maxX = static_cast<int>(std::floor((area.x + area.width) / cellSize));
+    int maxY = static_cast<int>(std::floor((area.y + area.height) / cellSize));
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            auto cell = cells.find(cellKey(x, y));
+            if (cell == cells.end()) continue;
+            found.insert(found.end(), cell->second.begin(), cell->second.end());
+        }
+    }
+
+    // Entries spanning several cells were collected more than once
+    std::sort(found.begin(), found.end());
+    found.erase(std::unique(found.begin(), found.end()), found.end());
+}
+
+/**
+ * cellKey implementation
+ * @param cellX Horizontal cell coordinate
+ * @param cellY Vertical cell coordinate
+ * @return Key with X in the high 32 bits and Y in the low 32 bits
+ */
+int64_t SpatialGrid::cellKey(int cellX, int cellY) {
+    // Pack through unsigned: shifting a negative signed value is undefined, and
+    // cells above or left of the view have negative coordinates
+    uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY);
+    return static_cast<int64_t>(key);
+}
+
+/**
+ * bladeCorners implementation
+ * The blade starts upright beside the pivot (like the weapon texture) and
+ * rotates away from the character: clockwise facing right, counter-clockwise facing left
+ * @param swing Swing being performed
+ * @param progress Fraction of the arc travelled
+ * @param corners Receives the four corners in order around the blade
+ */
+void bladeCorners(const WeaponSwing& swing, float progress, Vector2 corners[4]) {
+    // Unrotated blade relative to the pivot (bottom corner at the pivot)
+    float left = swing.rightLeft > 0.f ? 0.f : -swing.bladeSize.x;
+    Vector2 local[4] = {
+        {left, -swing.bladeSize.y},
+        {left + swing.bladeSize.x, -swing.bladeSize.y},
+        {left + swing.bladeSize.x, 0.f},
+        {left, 0.f}
+    };
+    // Same rotation direction as DrawTexturePro (positive = clockwise on screen)
+    float rotation = swing.rightLeft * swing.arc * progress * DEG2RAD;
+    for (int i = 0; i < 4; i++) {
+        corners[i] = Vector2Add(swing.pivot, Vector2Rotate(local[i], rotation));
+    }
+}
+
+/**
+ * Projects points onto an axis
+ * @param points Points to project
+ * @param count Number of points
+ * @param axis Axis to project onto (does not need to be normalized)
+ * @param min Receives the smallest projection
+ * @param max Receives the largest projection
+ */
+static void project(const Vector2* points, int count, Vector2 axis, float& min, float& max) {
+    min = max = Vector2DotProduct(points[0], axis);
+    for (int i = 1; i < count; i++) {
+        float p = Vector2DotProduct(points[i], axis);
+        min = std::min(min, p);
+        max = std::max(max, p);
+    }
+}
+
+/**
+ * Tests an oriented box against an axis-aligned rectangle (separating axis test)
+ * @param box Corners of the oriented box, in order around the box
+ * @param rec Axis-aligned rectangle
+ * @return true if the two overlap
+ */
+static bool boxOverlapsRec(const Vector2 box[4], Rectangle rec) {
+    Vector2 recCorners[4] = {
+        {rec.x, rec.y},
+        {rec.x + rec.width, rec.y},
+        {rec.x + rec.width, rec.y + rec.height},
+        {rec.x, rec.y + rec.height}
+    };
+    // Rectangle axes plus the two edge directions of the box
+    Vector2 axes[4] = {
+        {1.f, 0.f},
+        {0.f, 1.f},
+        Vector2Subtract(box[1], box[0]),
+        Vector2Subtract(box[3], box[0])
+    };
+    for (auto axis : axes) {
+        float boxMin, boxMax, recMin, recMax;
+        project(box, 4, axis, boxMin, boxMax);
+        project(recCorners, 4, axis, recMin, recMax);
+        if (boxMax < recMin || recMax < boxMin) return false;
+    }
+    return true;
+}
+
+/**
+ * resolveSwing implementation
+ * @param swing Swing to resolve
+ * @param fromProgress Fraction of the arc travelled at the start of the frame
+ * @param toProgress Fraction of the arc travelled at the end of the frame
+ * @param targets Broadphase grid of the targets that can be hit
+ * @param scratch Working memory kept between calls
+ * @param hits Receives one HitEvent per struck target
+ */
+void resolveSwing(const WeaponSwing& swing, float fromProgress, float toProgress,
+                  const SpatialGrid& targets, SwingScratch& scratch, std::vector<HitEvent>& hits) {
+    // Sample the blade along the part of the arc travelled this frame
+    float range = toProgress - fromProgress;
+    int steps = std::max(1, static_cast<int>(std::ceil(std::fabs(swing.arc * range) / maxSampleDegrees)));
+    std::vector<Vector2>& samples = scratch.samples;
+    samples.resize(4 * (steps + 1));
+    for (int i = 0; i <= steps; i++) {
+        bladeCorners(swing, fromProgress + range * i / steps, &samples[4 * i]);
+    }
+
+    // Area swept by the blade this frame
+    float minX = samples[0].x, maxX = samples[0].x;
+    float minY = samples[0].y, maxY = samples[0].y;
+    for (auto corner : samples) {
+        minX = std::min(minX, corner.x);
+        maxX = std::max(maxX, corner.x);
+        minY = std::min(minY, corner.y);
+        maxY = std::max(maxY, corner.y);
+    }
+
+    // Single broadphase query for the swept area
+    std::vector<int>& candidates = scratch.candidates;
+    targets.query(Rectangle{minX, minY, maxX - minX, maxY - minY}, candidates);
+
+    // Narrowphase: a candidate is struck if any blade sample overlaps it
+    for (int target : candidates) {
+        Rectangle bounds = targets.getBounds(target);
+        for (int i = 0; i <= steps; i++) {
+            if (boxOverlapsRec(&samples[4 * i], bounds)) {
+                hits.push_back(HitEvent{target, swing.damage});
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,131 @@
+// Header guard to prevent multiple inclusions
+#ifndef COMBAT_H
+#define COMBAT_H
+
+// Raylib library for graphics, textures, and vector/math types
+#include "raylib.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * WeaponSwing
+ * Describes a melee swing: a blade rotating around a pivot over its duration
+ * All positions are in screen space, like every other collision rectangle in the game
+ */
+struct WeaponSwing {
+    // Point the blade rotates around (the hilt)
+    Vector2 pivot{};
+    // Scaled size of the blade before rotation
+    Vector2 bladeSize{};
+    // Facing direction: 1.0 = blade extends to the right, -1.0 = to the left
+    float rightLeft{1.f};
+    // Total rotation of the swing in degrees (applied away from the character)
+    float arc{35.f};
+    // Time the blade takes to travel the whole arc, in seconds
+    float duration{0.1f};
+    // Damage dealt to every character struck by the swing
+    float damage{100.f};
+};
+
+/**
+ * A single target struck by a swing
+ */
+struct HitEvent {
+    // Id the target was inserted into the SpatialGrid with
+    int target{0};
+    // Damage to apply to the target
+    float damage{0.f};
+};
+
+/**
+ * SpatialGrid
+ * Uniform grid broadphase: bounds are bucketed by the cells they overlap
+ * so an area query only looks at nearby entries instead of every entry
+ */
+class SpatialGrid {
+    public:
+        /**
+         * Constructor
+         * @param cellSize Width and height of a grid cell (should be around the size of an entry)
+         */
+        explicit SpatialGrid(float cellSize = 64.f);
+
+        /**
+         * Removes every entry (cells keep their memory for the next rebuild)
+         */
+        void clear();
+
+        /**
+         * Adds an entry to every cell its bounds overlap
+         * @param id Small non-negative id of the entry (e.g., index in the enemy array)
+         * @param bounds Collision rectangle of the entry
+         */
+        void insert(int id, Rectangle bounds);
+
+        /**
+         * Finds every entry whose cells overlap an area
+         * Candidates may not actually overlap the area; callers run their own narrowphase
+         * @param area Rectangle to search
+         * @param found Receives the ids of the candidates, each once (cleared first)
+         */
+        void query(Rectangle area, std::vector<int>& found) const;
+
+        /**
+         * Gets the bounds an entry was inserted with
+         * @param id Id of an inserted entry
+         * @return Collision rectangle of the entry
+         */
+        Rectangle getBounds(int id) const { return bounds[id]; }
+
+    private:
+        /**
+         * Packs cell coordinates into a single hash key
+         */
+        static int64_t cellKey(int cellX, int cellY);
+
+        // Width and height of a cell
+        float cellSize{64.f};
+        // Ids of the entries overlapping each occupied cell
+        std::unordered_map<int64_t, std::vector<int>> cells;
+        // Bounds of every inserted entry, indexed by id
+        std::vector<Rectangle> bounds;
+};
+
+/**
+ * Working memory reused by resolveSwing
+ * Owned by the caller so resolving a swing every frame does not allocate once it has grown
+ */
+struct SwingScratch {
+    // Blade corners of every sample, four per sample
+    std::vector<Vector2> samples;
+    // Broadphase candidates of the swept area
+    std::vector<int> candidates;
+};
+
+/**
+ * Resolves the part of a swing the blade travels through in one frame, in one batch
+ * The blade is sampled as an oriented box at small angle steps along that part of the arc;
+ * a single broadphase query covers the swept area and each candidate is tested
+ * against the samples, so a target is hit if the blade passes over it at any point.
+ * Calling this each frame with consecutive ranges applies hits as the blade reaches
+ * targets; callers filter out targets already struck earlier in the swing
+ * @param swing Swing to resolve
+ * @param fromProgress Fraction of the arc travelled at the start of the frame (0 = start)
+ * @param toProgress Fraction of the arc travelled at the end of the frame (1 = end)
+ * @param targets Broadphase grid of the targets that can be hit
+ * @param scratch Working memory kept between calls
+ * @param hits Receives one HitEvent per struck target (appended)
+ */
+void resolveSwing(const WeaponSwing& swing, float fromProgress, float toProgress,
+                  const SpatialGrid& targets, SwingScratch& scratch, std::vector<HitEvent>& hits);
+
+/**
+ * Calculates the corners of the blade at a point of the swing
+ * @param swing Swing being performed
+ * @param progress Fraction of the arc travelled (0 = start, 1 = end)
+ * @param corners Receives the four corners in order around the blade
+ */
+void bladeCorners(const WeaponSwing& swing, float progress, Vector2 corners[4]);
+
+#endif
@@ -4,26 +4,20 @@
 
 /**
  * Constructor implementation
- * Initializes the enemy with custom textures, position, and properties
- * @param idle_texture Texture for idle animation
- * @param run_texture Texture for running animation
+ * Initializes the enemy with its clips, position, and properties
+ * Sprite dimensions come from the clip definitions (see BaseCharacter)
+ * @param animations Shared clip definitions
+ * @param clock Shared animation clock
+ * @param idleClipName Name of the idle clip
+ * @param runClipName Name of the running clip
  * @param pos Starting world position of the enemy
  */
-Enemy::Enemy(Texture2D idle_texture, Texture2D run_texture, Vector2 pos)
+Enemy::Enemy(const AnimationLibrary& animations, const AnimationClock& clock,
+             const std::string& idleClipName, const std::string& runClipName, Vector2 pos):
+    BaseCharacter(animations, clock, idleClipName, runClipName)
 {
-    // Set current texture to idle (initial state)
-    texture = idle_texture;
-    // Store idle texture for animation switching
-    idle = idle_texture;
-    // Store run texture for animation switching
-    run = run_texture;
     // Set the enemy's starting world position
     worldPos = pos;
-    // Calculate width of a single frame from the spritesheet
-    // Spritesheet contains multiple frames horizontally
-    width = texture.width / maxFrames;
-    // Height is the full height of the texture (single row spritesheet)
-    height = texture.height;
     // Set enemy movement speed (slower than player for balance)
     speed = 3.f;
 }
@@ -60,7 +54,7 @@ void Enemy::tick(float deltaTime) {
         velocity = {};  // Set velocity to zero (stop moving)
     };
 
-    // Call base class tick to handle movement, animation, and rendering
+    // Call base class tick to handle movement and animation
     BaseCharacter::tick(deltaTime);
     
     // Check for collision between enemy and target (player)
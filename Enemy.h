@@ -1,3 +1,7 @@
+// Header guard to prevent multiple inclusions
+#ifndef ENEMY_H
+#define ENEMY_H
+
 // Raylib library for graphics, textures, and vector/math types
 #include "raylib.h"
 // Base class for character functionality
@@ -11,18 +15,21 @@
  * Inherits from BaseCharacter and adds enemy-specific AI behavior:
  * - Automatic targeting and movement toward player
  * - Damage dealing on contact
- * - Custom textures for different enemy types
+ * - Custom animation clips for different enemy types
  */
 class Enemy: public BaseCharacter {  
     public:
         /**
          * Constructor
-         * Initializes the enemy with custom textures and starting position
-         * @param idle_texture Texture for idle animation
-         * @param run_texture Texture for running animation
+         * Initializes the enemy with its clips and starting position
+         * @param animations Shared clip definitions
+         * @param clock Shared animation clock
+         * @param idleClipName Name of the idle clip (e.g., "goblin_idle")
+         * @param runClipName Name of the running clip (e.g., "goblin_run")
          * @param pos Starting world position of the enemy
          */
-        Enemy(Texture2D idle_texture, Texture2D run_texture, Vector2 pos);
+        Enemy(const AnimationLibrary& animations, const AnimationClock& clock,
+              const std::string& idleClipName, const std::string& runClipName, Vector2 pos);
         
         /**
          * Override of BaseCharacter::tick
@@ -53,4 +60,6 @@ class Enemy: public BaseCharacter {
         float damagePerSec{10.f};
         // Radius around the enemy for collision/damage detection
         float radius{25.f};
-};
\ No newline at end of file
+};
+
+#endif
\ No newline at end of file
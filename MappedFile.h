@@ -0,0 +1,59 @@
+// Header guard to prevent multiple inclusions
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+
+/**
+ * MappedFile class
+ * Read-only memory mapping of a whole file
+ * Pages are read by the OS on first access instead of copied into a buffer up front
+ * Kept free of raylib so the platform headers it needs do not clash with raylib's names
+ */
+class MappedFile {
+    public:
+        MappedFile() = default;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * Destructor
+         * Unmaps the file if it is still open
+         */
+        ~MappedFile();
+
+        /**
+         * Maps a file into memory (closing any file mapped before)
+         * @param fileName Path of the file to map
+         * @return true if the file was mapped
+         */
+        bool open(const char* fileName);
+
+        /**
+         * Unmaps the file; pointers returned by data() become invalid
+         */
+        void close();
+
+        /**
+         * Gets the mapped bytes
+         * @return Pointer to the start of the file, or nullptr if nothing is mapped
+         */
+        const unsigned char* data() const { return bytes; }
+
+        /**
+         * Gets the size of the mapped file
+         * @return Size in bytes (0 if nothing is mapped)
+         */
+        size_t size() const { return length; }
+
+    private:
+        // Start of the mapping
+        const unsigned char* bytes{nullptr};
+        // Length of the mapping in bytes
+        size_t length{0};
+        // Windows file and file-mapping handles (unused on other platforms)
+        void* fileHandle{nullptr};
+        void* mappingHandle{nullptr};
+};
+
+#endif
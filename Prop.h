@@ -1,3 +1,7 @@
+// Header guard to prevent multiple inclusions
+#ifndef PROP_H
+#define PROP_H
+
 // Raylib library for graphics, textures, and vector/math types
 #include "raylib.h"
 
@@ -37,4 +41,6 @@ class Prop {
         Vector2 worldPos{};
         // Scale factor for rendering the prop texture (default: 4x)
         float scale{4.f};
-};
\ No newline at end of file
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include "World.h"
+// Raylib math utilities for vector operations
+#include "raymath.h"
+
+/**
+ * Constructor implementation
+ * @param animations Shared clip definitions
+ * @param viewWidth Width of the view the knight is centered in
+ * @param viewHeight Height of the view the knight is centered in
+ * @param map Texture of the world map
+ * @param sword Texture of the knight's weapon
+ */
+World::World(const AnimationLibrary& animations, int viewWidth, int viewHeight, Texture2D map, Texture2D sword):
+    animations(&animations),
+    viewWidth(viewWidth),
+    viewHeight(viewHeight),
+    map(map),
+    knight(viewWidth, viewHeight, animations, clock, sword)
+{
+    // Member variables initialized via initializer list above
+}
+
+/**
+ * addEnemy implementation
+ * @param idleClipName Name of the enemy's idle clip
+ * @param runClipName Name of the enemy's running clip
+ * @param pos Starting world position of the enemy
+ */
+void World::addEnemy(const std::string& idleClipName, const std::string& runClipName, Vector2 pos) {
+    enemies.emplace_back(*animations, clock, idleClipName, runClipName, pos);
+    enemies.back().setTarget(&knight);
+    struckBySwing.push_back(0);
+}
+
+/**
+ * addProp implementation
+ * @param pos World position of the prop
+ * @param texture Texture of the prop
+ */
+void World::addProp(Vector2 pos, Texture2D texture) {
+    props.emplace_back(pos, texture);
+}
+
+/**
+ * step implementation
+ * Same order as the original game loop: knight, bounds and props, enemies, then combat
+ * A swing is resolved over the ticks the blade takes to travel its arc
+ * @param deltaTime Time elapsed since last frame
+ * @param input Player input for this frame
+ */
+void World::step(float deltaTime, const InputState& input) {
+    // The game is over once the knight is dead
+    if (!knight.getAlive()) return;
+    ticks++;
+
+    // Advance the world's animation clock once for every character
+    clock.advance(deltaTime);
+
+    // Update knight's state (movement, animation, weapon swing)
+    knight.setInput(input);
+    knight.tick(deltaTime);
+
+    // Boundary checking: prevent knight from moving outside map bounds
+    if (knight.getWorldPos().x < 0.f ||
+        knight.getWorldPos().x + viewWidth > map.width*mapScale ||
+        knight.getWorldPos().y < 0.f ||
+        knight.getWorldPos().y + viewHeight > map.height*mapScale)
+    {
+        // Revert movement if knight would go out of bounds
+        knight.undoMovement();
+    }
+
+    // Check for collision between knight and props
+    for (auto& prop : props) {
+        if (CheckCollisionRecs(knight.GetCollisionRec(), prop.GetCollisionRec(knight.getWorldPos()))) {
+            // Revert movement if collision detected
+            knight.undoMovement();
+        }
+    }
+
+    // Update all enemies (movement, AI, animation, etc.)
+    for (auto& enemy : enemies) {
+        enemy.tick(deltaTime);
+    }
+
+    // Combat system: a new swing can strike every enemy again
+    if (input.attackPressed) swingCount++;
+    // Resolve the part of the arc the blade travelled this tick, so enemies are
+    // hit when the drawn sword reaches them
+    if (knight.isSwinging()) {
+        // Rebuild the broadphase grid now that enemies have moved; idle ticks skip it
+        enemyGrid.clear();
+        for (size_t i = 0; i < enemies.size(); i++) {
+            if (enemies[i].getAlive()) enemyGrid.insert(static_cast<int>(i), enemies[i].GetCollisionRec());
+        }
+
+        hits.clear();
+        resolveSwing(knight.getWeaponSwing(), knight.getSwingFrom(), knight.getSwingTo(), enemyGrid, swingScratch, hits);
+        // Apply the swing's damage to every enemy not already struck by this swing
+        for (auto hit : hits) {
+            if (struckBySwing[hit.target] == swingCount) continue;
+            struckBySwing[hit.target] = swingCount;
+            enemies[hit.target].takeDamage(hit.damage);
+        }
+    }
+}
+
+/**
+ * draw implementation
+ * Everything is drawn relative to the knight's world position (camera follows player)
+ */
+void World::draw() {
+    // Negative scaling of the knight's position creates the camera effect
+    Vector2 mapPos = Vector2Scale(knight.getWorldPos(), -1.f);
+    // Draw the map background
+    DrawTextureEx(map, mapPos, 0, mapScale, WHITE);
+
+    // Draw all props in the world
+    for (auto& prop : props) {
+        prop.Render(knight.getWorldPos());
+    }
+
+    // Draw the knight, then the enemies on top
+    knight.draw();
+    for (auto& enemy : enemies) {
+        enemy.draw();
+    }
+}
+
+/**
+ * getOutcome implementation
+ * @return Whether the game is still running, won or lost
+ */
+WorldOutcome World::getOutcome() {
+    if (!knight.getAlive()) return WorldOutcome::Lost;
+    for (auto& enemy : enemies) {
+        if (enemy.getAlive()) return WorldOutcome::Running;
+    }
+    return WorldOutcome::Won;
+}
+
+/**
+ * populateLevel implementation
+ * @param world World to populate
+ * @param rock Texture of the rock props
+ */
+void populateLevel(World& world, Texture2D rock) {
+    // Enemies with their idle and run clips, and starting positions
+    world.addEnemy("goblin_idle", "goblin_run", Vector2{500.f, 700.f});
+    world.addEnemy("slime_idle", "slime_run", Vector2{800.f, 100.f});
+
+    // Static props (rocks) in the world
+    world.addProp(Vector2{600.f, 300.f}, rock);
+    world.addProp(Vector2{400.f, 500.f}, rock);
+}
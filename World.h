@@ -0,0 +1,145 @@
+// Header guard to prevent multiple inclusions
+#ifndef WORLD_H
+#define WORLD_H
+
+// Raylib library for graphics, textures, and vector/math types
+#include "raylib.h"
+// Shared animation clips and per-world clock
+#include "Animation.h"
+// Player character and its input
+#include "Character.h"
+// Hostile characters
+#include "Enemy.h"
+// Static objects in the world
+#include "Prop.h"
+// Weapon swing hit detection
+#include "Combat.h"
+#include <string>
+#include <vector>
+
+/**
+ * State of a game
+ */
+enum class WorldOutcome {
+    Running,    // Knight alive and enemies left
+    Won,        // Every enemy is dead
+    Lost        // Knight is dead
+};
+
+/**
+ * World class
+ * One complete game: the knight, enemies, props and map, plus its own animation clock
+ * Holds no global state and reads no global input, so many worlds can be stepped
+ * side by side (e.g., on different threads); only draw() needs a window
+ */
+class World {
+    public:
+        /**
+         * Constructor
+         * Creates a world containing only the knight; see populateLevel for the game's level
+         * @param animations Shared clip definitions (must outlive the world)
+         * @param viewWidth Width of the view the knight is centered in
+         * @param viewHeight Height of the view the knight is centered in
+         * @param map Texture of the world map (its size sets the world bounds)
+         * @param sword Texture of the knight's weapon (its size sets the blade size)
+         */
+        World(const AnimationLibrary& animations, int viewWidth, int viewHeight, Texture2D map, Texture2D sword);
+
+        // Enemies point at the knight, so a world cannot be copied or moved
+        World(const World&) = delete;
+        World& operator=(const World&) = delete;
+
+        /**
+         * Adds an enemy that chases the knight
+         * @param idleClipName Name of the enemy's idle clip
+         * @param runClipName Name of the enemy's running clip
+         * @param pos Starting world position of the enemy
+         */
+        void addEnemy(const std::string& idleClipName, const std::string& runClipName, Vector2 pos);
+
+        /**
+         * Adds a static prop that blocks the knight
+         * @param pos World position of the prop
+         * @param texture Texture of the prop (its size sets the collision bounds)
+         */
+        void addProp(Vector2 pos, Texture2D texture);
+
+        /**
+         * Advances the game by one frame
+         * Moves the knight, keeps it inside the map and out of props, updates enemies
+         * and resolves the part of the knight's swing travelled this tick; does nothing once the knight is dead
+         * @param deltaTime Time elapsed since last frame
+         * @param input Player input for this frame
+         */
+        void step(float deltaTime, const InputState& input);
+
+        /**
+         * Draws the map, props and characters as seen from the knight
+         */
+        void draw();
+
+        /**
+         * Gets the state of the game
+         * @return Whether the game is still running, won or lost
+         */
+        WorldOutcome getOutcome();
+
+        /**
+         * Gets the knight (player)
+         * @return Reference to the knight
+         */
+        Character& getKnight() { return knight; }
+
+        /**
+         * Gets the enemies
+         * @return Reference to the enemies, in the order they were added
+         */
+        std::vector<Enemy>& getEnemies() { return enemies; }
+
+        /**
+         * Gets the number of frames stepped
+         * @return Number of step calls that advanced the game
+         */
+        long getTicks() const { return ticks; }
+
+    private:
+        // Shared clip definitions used when adding enemies
+        const AnimationLibrary* animations{};
+        // Width of the view the knight is centered in
+        int viewWidth{};
+        // Height of the view the knight is centered in
+        int viewHeight{};
+        // Animation clock of this world (declared before the characters that use it)
+        AnimationClock clock{};
+        // Texture of the world map
+        Texture2D map{};
+        // Scale factor for the map texture
+        float mapScale{4.f};
+        // Player character
+        Character knight;
+        // Enemies chasing the knight
+        std::vector<Enemy> enemies;
+        // Static props blocking the knight
+        std::vector<Prop> props;
+        // Broadphase grid of enemy bounds, rebuilt on each swinging tick after enemies move
+        SpatialGrid enemyGrid;
+        // Enemies struck by the blade during the current tick
+        std::vector<HitEvent> hits;
+        // Working memory of resolveSwing, kept so swinging ticks do not allocate
+        SwingScratch swingScratch;
+        // Number of swings started (identifies the current swing)
+        int swingCount{0};
+        // Last swing that struck each enemy (parallel to enemies), so a swing hits an enemy once
+        std::vector<int> struckBySwing;
+        // Number of frames stepped
+        long ticks{0};
+};
+
+/**
+ * Places the game's enemies and props in a world
+ * @param world World to populate
+ * @param rock Texture of the rock props
+ */
+void populateLevel(World& world, Texture2D rock);
+
+#endif
@@ -1,15 +1,29 @@
 // Raylib library for graphics, window management, and game utilities
 #include "raylib.h"
-// Raylib math utilities for vector operations
-#include "raymath.h"
-// Custom character class for the player (knight)
-#include "Character.h"
-// Custom prop class for static objects in the world
-#include "Prop.h"
-// Custom enemy class for hostile entities
-#include "Enemy.h"
+// Game world: knight, enemies, props and map
+#include "World.h"
+// Shared animation clips
+#include "Animation.h"
+// Pre-decoded texture bundle
+#include "AssetBundle.h"
 #include <string>
 
+/**
+ * Reads this frame's player input from the keyboard and mouse
+ * WASD controls: W=up, S=down, A=left, D=right; left mouse button attacks
+ * @return Input for the knight
+ */
+static InputState readInput() {
+    InputState input{};
+    if (IsKeyDown(KEY_A)) input.move.x += -1.0;  // Move left
+    if (IsKeyDown(KEY_D)) input.move.x += 1.0;    // Move right
+    if (IsKeyDown(KEY_W)) input.move.y += -1.0;   // Move up (negative Y is up in screen space)
+    if (IsKeyDown(KEY_S)) input.move.y += 1.0;    // Move down
+    input.attackPressed = IsMouseButtonPressed(MOUSE_BUTTON_LEFT);
+    input.attackHeld = IsMouseButtonDown(MOUSE_BUTTON_LEFT);
+    return input;
+}
+
 /**
  * Main game entry point
  * Implements a top-down action game with a knight character, enemies, and props
@@ -20,119 +34,70 @@ int main() {
     const int windowHeight = 384;
     // Initialize the game window
     InitWindow(windowWidth, windowHeight, "Top down");
-    
-    // Load the world map texture
-    Texture2D map = LoadTexture("nature_tileset/OpenWorldMap24x24.png");
-    // Map position (used for camera/offset calculations)
-    Vector2 mapPos = { 0.0, 0.0 };
-    // Scale factor for the map texture
-    const float mapScale = 4.0;
 
-    // Initialize the player character (knight)
-    Character knight(windowWidth, windowHeight);
-    
-    // Initialize enemies with their idle and run sprites, and starting positions
-    Enemy goblin(
-        LoadTexture("characters/goblin_idle_spritesheet.png"), 
-        LoadTexture("characters/goblin_run_spritesheet.png"), 
-        Vector2{500.f, 700.f}
-    );
-    Enemy slime(
-        LoadTexture("characters/slime_idle_spritesheet.png"), 
-        LoadTexture("characters/slime_run_spritesheet.png"), 
-        Vector2{800.f, 100.f}
-    );
-    
-    // Array of enemy pointers for easy iteration
-    Enemy* enemies[] = { 
-        &goblin, 
-        &slime 
-    };
+    // Map the pre-decoded texture bundle (built with 'make bundle')
+    // Textures missing from the bundle are loaded from their image files instead
+    AssetBundle assets;
+    assets.open("assets.bundle");
 
-    // Set all enemies to target the knight (player)
-    for (auto enemy : enemies) {
-        enemy->setTarget(&knight);
+    // Load the world map, weapon and prop textures
+    Texture2D map = assets.loadTexture("nature_tileset/OpenWorldMap24x24.png");
+    Texture2D sword = assets.loadTexture("characters/weapon_sword.png");
+    Texture2D rock = assets.loadTexture("nature_tileset/Rock.png");
+
+    // Load the animation clips shared by every character
+    AnimationLibrary animations;
+    if (!animations.load("characters/animations.txt", assets)) {
+        // Characters with missing clips would be invisible and impossible to hit
+        TraceLog(LOG_ERROR, "GAME: Invalid animation clips, see warnings above");
+        animations.unload();
+        UnloadTexture(map);
+        UnloadTexture(sword);
+        UnloadTexture(rock);
+        CloseWindow();
+        return 1;
     }
 
-    // Initialize static props (rocks) in the world
-    Prop props[2]{
-       Prop({600.f, 300.f}, LoadTexture("nature_tileset/Rock.png")),
-       Prop({400.f, 500.f}, LoadTexture("nature_tileset/Rock.png"))
-    };
+    // Every texture is on the GPU now, release the mapping
+    assets.close();
+
+    // Create the world with the knight, then place enemies and props
+    World world(animations, windowWidth, windowHeight, map, sword);
+    populateLevel(world, rock);
+    Character& knight = world.getKnight();
 
     // Set target frame rate to 60 FPS
     SetTargetFPS(60);
-    
+
     // Main game loop - runs until window is closed
     while (!WindowShouldClose()) {
+        // Update the knight, enemies and combat from this frame's input
+        world.step(GetFrameTime(), readInput());
+
         BeginDrawing();
         ClearBackground(WHITE);
 
-        // Calculate map position based on knight's world position (camera follows player)
-        // Negative scaling creates the parallax/camera effect
-        mapPos = Vector2Scale(knight.getWorldPos(), -1.f);
-        // Draw the map background
-        DrawTextureEx(map, mapPos, 0, mapScale, WHITE);
-
-        // Draw all props in the world
-        for (auto prop : props) {
-            prop.Render(knight.getWorldPos());
-        }
-
-        // Update knight's state (movement, animation, etc.)
-        knight.tick(GetFrameTime());
-        
-        // Boundary checking: prevent knight from moving outside map bounds
-        if (knight.getWorldPos().x < 0.f || 
-            knight.getWorldPos().x + windowWidth > map.width*mapScale || 
-            knight.getWorldPos().y < 0.f || 
-            knight.getWorldPos().y + windowHeight > map.height*mapScale) 
-        {
-            // Revert movement if knight would go out of bounds
-            knight.undoMovement();
-        }
-        
-        // Check for collision between knight and props
-        for (auto prop : props) {
-            if (CheckCollisionRecs(knight.GetCollisionRec(), prop.GetCollisionRec(knight.getWorldPos()))) {
-                // Revert movement if collision detected
-                knight.undoMovement();
-            }
-        }
+        // Draw the map, props and characters
+        world.draw();
 
         // Check if knight is still alive
         if (!knight.getAlive()) {
             // Display game over message
             DrawText("Game Over", 55.f, 45.f, 40, RED);
-            EndDrawing();
-            continue; // Skip rest of frame if game over
         } else {
             // Display knight's current health
             std::string knightHealth = "Health: ";
             knightHealth.append(std::to_string(knight.getHealth()), 0, 5);
             DrawText(knightHealth.c_str(), 55.f, 45.f, 40, RED);
         }
-        
-        // Update all enemies (movement, AI, animation, etc.)
-        for (auto enemy : enemies) {    
-            enemy->tick(GetFrameTime());
-        }
-
-        // Combat system: check for weapon hits when left mouse button is pressed
-        if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
-            // Check collision between knight's weapon and each enemy
-            for (auto enemy : enemies) {
-                if (CheckCollisionRecs(knight.getWeaponCollisionRec(), enemy->GetCollisionRec())) {
-                    // Kill enemy if hit by weapon
-                    enemy->setAlive(false);
-                }
-            }
-        }
 
         EndDrawing();
     }
-    
+
     // Cleanup: close window and unload resources
-    CloseWindow();
     UnloadTexture(map);
-}
\ No newline at end of file
+    UnloadTexture(sword);
+    UnloadTexture(rock);
+    animations.unload();
+    CloseWindow();
+}
@@ -0,0 +1,84 @@
+// Raylib library for image loading and pixel formats
+#include "raylib.h"
+// Bundle file layout shared with the game
+#include "AssetBundle.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+/**
+ * Asset packer entry point
+ * Decodes every image given on the command line and writes them, with an index
+ * and checksums, into a single bundle the game maps and uploads without decoding
+ * Usage: packer <output bundle> <image> [image...]
+ */
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::fprintf(stderr, "Usage: %s <output bundle> <image> [image...]\n", argv[0]);
+        return 1;
+    }
+    const char* bundleName = argv[1];
+    const int imageCount = argc - 2;
+
+    // Decode every image and lay out its data after the header and index
+    std::vector<Image> images;
+    std::vector<BundleEntry> entries(imageCount);
+    uint64_t offset = sizeof(BundleHeader) + imageCount * sizeof(BundleEntry);
+    for (int i = 0; i < imageCount; i++) {
+        const char* path = argv[i + 2];
+        if (std::strlen(path) >= bundlePathSize) {
+            std::fprintf(stderr, "packer: path too long: %s\n", path);
+            return 1;
+        }
+        Image image = LoadImage(path);
+        if (image.data == nullptr) {
+            std::fprintf(stderr, "packer: failed to decode %s\n", path);
+            return 1;
+        }
+        images.push_back(image);
+
+        // Start each texture on an aligned boundary
+        offset = (offset + bundleDataAlignment - 1) / bundleDataAlignment * bundleDataAlignment;
+
+        BundleEntry& entry = entries[i];
+        std::memset(&entry, 0, sizeof(entry));
+        std::strncpy(entry.path, path, bundlePathSize - 1);
+        entry.width = static_cast<uint32_t>(image.width);
+        entry.height = static_cast<uint32_t>(image.height);
+        // Pixels are stored in the format they decoded to, ready to upload as is
+        entry.format = static_cast<uint32_t>(image.format);
+        entry.mipmaps = static_cast<uint32_t>(image.mipmaps);
+        entry.offset = offset;
+        entry.size = static_cast<uint64_t>(GetPixelDataSize(image.width, image.height, image.format));
+        entry.checksum = bundleChecksum(image.data, entry.size);
+        offset += entry.size;
+    }
+
+    BundleHeader header{};
+    std::memcpy(header.magic, bundleMagic, sizeof(bundleMagic));
+    header.version = bundleVersion;
+    header.entryCount = static_cast<uint32_t>(imageCount);
+    header.indexChecksum = bundleChecksum(entries.data(), entries.size() * sizeof(BundleEntry));
+
+    // Write header, index, then each texture's data at its offset
+    std::ofstream bundle(bundleName, std::ios::binary | std::ios::trunc);
+    bundle.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    bundle.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(BundleEntry));
+    const char padding[bundleDataAlignment]{};
+    for (int i = 0; i < imageCount; i++) {
+        uint64_t position = static_cast<uint64_t>(bundle.tellp());
+        bundle.write(padding, static_cast<std::streamsize>(entries[i].offset - position));
+        bundle.write(static_cast<const char*>(images[i].data), static_cast<std::streamsize>(entries[i].size));
+        UnloadImage(images[i]);
+    }
+    bundle.close();
+
+    if (!bundle) {
+        std::fprintf(stderr, "packer: failed to write %s\n", bundleName);
+        return 1;
+    }
+    std::printf("packer: wrote %d textures (%llu bytes) to %s\n",
+                imageCount, static_cast<unsigned long long>(offset), bundleName);
+    return 0;
+}
@@ -0,0 +1,171 @@
+// Raylib library for vector/math types and logging
+#include "raylib.h"
+// Raylib math utilities for vector operations
+#include "raymath.h"
+// Game world: knight, enemies, props and map
+#include "World.h"
+// Shared animation clips
+#include "Animation.h"
+// Pre-decoded texture bundle (for texture sizes)
+#include "AssetBundle.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Fixed simulation step (the game targets 60 FPS)
+static const float stepTime{1.f / 60.f};
+// Distance to an enemy at which the bot starts swinging
+static const float attackRange{80.f};
+
+/**
+ * Scripted player: walks toward the nearest living enemy and swings when close
+ * Each bot has its own random generator, so worlds play out differently but reproducibly
+ */
+class Bot {
+    public:
+        /**
+         * Constructor
+         * @param seed Seed of the bot's random generator
+         */
+        explicit Bot(unsigned seed): rng(seed) {}
+
+        /**
+         * Decides this frame's input from the state of the world
+         * @param world World the bot plays in
+         * @return Input for the knight
+         */
+        InputState think(World& world) {
+            InputState input{};
+            Character& knight = world.getKnight();
+
+            // Keep wandering in a random direction for a while (gets the knight around rocks)
+            if (wanderTicks > 0) {
+                wanderTicks--;
+                input.move = wanderDirection;
+            } else {
+                // Chase the nearest living enemy
+                float nearest{-1.f};
+                for (auto& enemy : world.getEnemies()) {
+                    if (!enemy.getAlive()) continue;
+                    Vector2 toEnemy = Vector2Subtract(enemy.getScreenPos(), knight.getScreenPos());
+                    float distance = Vector2Length(toEnemy);
+                    if (nearest < 0.f || distance < nearest) {
+                        nearest = distance;
+                        input.move = toEnemy;
+                    }
+                }
+                // Swing whenever the nearest enemy is in range and the bot is ready
+                if (nearest >= 0.f && nearest < attackRange && cooldown <= 0) {
+                    input.attackPressed = true;
+                    cooldown = std::uniform_int_distribution<int>(10, 40)(rng);
+                }
+                // Occasionally wander off, as if blocked or distracted
+                if (std::uniform_int_distribution<int>(0, 199)(rng) == 0) {
+                    std::uniform_real_distribution<float> axis(-1.f, 1.f);
+                    wanderDirection = {axis(rng), axis(rng)};
+                    wanderTicks = 30;
+                }
+            }
+
+            // Hold the sword raised for a moment after each swing
+            if (cooldown > 0) cooldown--;
+            input.attackHeld = cooldown > 0;
+            return input;
+        }
+
+    private:
+        // Random generator for swing timing and wandering
+        std::mt19937 rng;
+        // Frames until the bot may swing again
+        int cooldown{0};
+        // Frames left to keep wandering
+        int wanderTicks{0};
+        // Direction to wander in
+        Vector2 wanderDirection{};
+};
+
+/**
+ * Headless match runner entry point
+ * Plays many independent worlds with bots, spread over a pool of threads,
+ * and reports throughput and outcomes
+ * Usage: runner [worlds] [threads] [max ticks per world]
+ */
+int main(int argc, char* argv[]) {
+    const int worldCount = argc > 1 ? std::atoi(argv[1]) : 1000;
+    const int threadCount = argc > 2 ? std::atoi(argv[2]) : std::max(1u, std::thread::hardware_concurrency());
+    const long maxTicks = argc > 3 ? std::atol(argv[3]) : 60 * 60;
+    if (worldCount < 1 || threadCount < 1 || maxTicks < 1) {
+        std::fprintf(stderr, "Usage: %s [worlds] [threads] [max ticks per world]\n", argv[0]);
+        return 1;
+    }
+
+    // Only texture sizes are needed: no window, nothing is uploaded
+    SetTraceLogLevel(LOG_WARNING);
+    AssetBundle assets;
+    assets.open("assets.bundle");
+    Texture2D map = assets.loadTextureInfo("nature_tileset/OpenWorldMap24x24.png");
+    Texture2D sword = assets.loadTextureInfo("characters/weapon_sword.png");
+    Texture2D rock = assets.loadTextureInfo("nature_tileset/Rock.png");
+    // Clip definitions are read-only after loading and shared by every world
+    AnimationLibrary animations;
+    if (!animations.load("characters/animations.txt", assets, false)) {
+        std::fprintf(stderr, "runner: failed to load characters/animations.txt\n");
+        return 1;
+    }
+    assets.close();
+
+    // Outcome and length of every world, each written by exactly one thread
+    std::vector<WorldOutcome> outcomes(worldCount, WorldOutcome::Running);
+    std::vector<long> ticks(worldCount, 0);
+    // Next world to play; threads take worlds until none are left
+    std::atomic<int> nextWorld{0};
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threadCount; t++) {
+        pool.emplace_back([&]() {
+            for (int i = nextWorld++; i < worldCount; i = nextWorld++) {
+                // Each world is built, played and destroyed on the thread that runs it
+                World world(animations, 384, 384, map, sword);
+                populateLevel(world, rock);
+                Bot bot(static_cast<unsigned>(i));
+                while (world.getOutcome() == WorldOutcome::Running && world.getTicks() < maxTicks) {
+                    world.step(stepTime, bot.think(world));
+                }
+                outcomes[i] = world.getOutcome();
+                ticks[i] = world.getTicks();
+            }
+        });
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Aggregate results
+    long long totalTicks{0};
+    int won{0}, lost{0}, timedOut{0};
+    for (int i = 0; i < worldCount; i++) {
+        totalTicks += ticks[i];
+        if (outcomes[i] == WorldOutcome::Won) won++;
+        else if (outcomes[i] == WorldOutcome::Lost) lost++;
+        else timedOut++;
+    }
+
+    std::printf("worlds:      %d\n", worldCount);
+    std::printf("threads:     %d\n", threadCount);
+    std::printf("ticks:       %lld (%.1f per world)\n", totalTicks, static_cast<double>(totalTicks) / worldCount);
+    std::printf("time:        %.3f s\n", seconds);
+    std::printf("ticks/sec:   %.0f\n", seconds > 0.0 ? totalTicks / seconds : 0.0);
+    std::printf("won:         %d\n", won);
+    std::printf("lost:        %d\n", lost);
+    std::printf("timed out:   %d\n", timedOut);
+
+    animations.unload();
+    return 0;
+}